@@ -0,0 +1,150 @@
+#ifndef BITMAP_H
+#define BITMAP_H
+
+#include "index.h"
+
+
+// A tuple is represented by one bit, at its position in the heap
+// file: a page has room for at most BITMAPSLOTS slots.
+
+#define BITMAPSLOTS  (int)(PAGESIZE / sizeof(slot_t))
+
+int bitmapPos(const RID & rid);
+const RID bitmapRid(const int pos);
+
+
+// A bitmap compressed with word-aligned hybrid (WAH) run-length
+// encoding. The bits are cut into groups of 31, each stored in one
+// 32-bit word:
+//
+//   literal  high bit 0, the 31 bits of one group (bit i of the word
+//            is bit 31 * group + i of the bitmap)
+//   fill     high bit 1, bit 30 the value of all bits of a run of
+//            groups, the low 30 bits the # of groups in the run
+//
+// Runs of all-0 or all-1 groups thus take a single word, and the
+// bitmaps of low-cardinality attributes stay small. AND and OR work
+// on the compressed words and skip whole runs at a time.
+
+#define WAHGROUP     31
+#define WAHFILL      0x80000000u
+#define WAHFILLBIT   0x40000000u
+#define WAHLITERAL   0x7fffffffu
+#define WAHMAXRUN    0x3fffffff
+
+class WAHBitmap {
+ public:
+  WAHBitmap() : groupCnt(0) {}
+
+  // set/clear bit pos; bitmaps grow as needed
+  void set(const int pos, const bool bit);
+  const bool test(const int pos) const;
+
+  // this = this AND/OR other
+  void intersect(const WAHBitmap & other);
+  void unite(const WAHBitmap & other);
+
+  // # of bits set, and their positions in increasing order
+  const int count() const;
+  void positions(vector<int> & pos) const;
+
+  // the compressed words, e.g. for storing the bitmap on disk
+  const vector<unsigned int> & getWords() const { return words; }
+  void setWords(const unsigned int *w, const int wordCnt);
+
+ private:
+  void appendRun(const unsigned int group, int runLen);
+  void combine(const WAHBitmap & other, const bool isAnd);
+
+  vector<unsigned int> words;           // compressed bitmap
+  int groupCnt;                         // # of groups covered by words
+};
+
+
+// Header page of a bitmap index file. It is the first page of the
+// file and stays pinned while the index is open.
+//
+// The index has one bitmap per distinct key. The directory lists the
+// keys with the first page of their bitmaps; it is read into memory
+// when the index is opened and written back when it is closed.
+
+typedef struct {
+  int attrType;                         // type of key
+  int keyLen;                           // length of key in bytes
+  int valueCnt;                         // # of distinct keys
+  int dirPageNo;                        // first directory page, or -1
+} BitmapHdr;
+
+
+// Directory page holding (key, first bitmap page) entries. A key whose
+// bitmap is empty has no bitmap pages.
+
+typedef struct {
+  int nextDir;                          // next directory page, or -1
+  int entryCnt;                         // # of entries in data[]
+  char data[PAGESIZE - 2 * sizeof(int)];
+} BitmapDir;
+
+
+// Page holding part of the compressed words of one bitmap.
+
+#define BITMAPWORDS  (int)((PAGESIZE - 2 * sizeof(int)) / sizeof(unsigned int))
+
+typedef struct {
+  int nextPage;                         // next page of bitmap, or -1
+  int wordCnt;                          // # of words in words[]
+  unsigned int words[BITMAPWORDS];
+} BitmapPage;
+
+
+class BitmapIndex : public Index {
+ public:
+  // open the index in file name, creating an empty one if the file
+  // does not exist
+  BitmapIndex(const string & name,
+	      const Datatype type,
+	      const int len,
+	      Status & status);
+  ~BitmapIndex();
+
+  const Status insertEntry(const void *value, const RID & rid);
+  const Status deleteEntry(const void *value, const RID & rid);
+
+  // add entries (value, rid) for the tuples whose bits are set
+  const Status insertEntries(const void *value, const WAHBitmap & bits);
+
+  // bits of the tuples with (key op value), or of all tuples if value
+  // is NULL: the OR of the bitmaps of the qualifying keys
+  const Status lookup(const void *value, const Operator op,
+		      WAHBitmap & bits);
+
+  // scans return RIDs in page order
+  const Status startScan(const void *value, const Operator op);
+  const Status scanNext(RID & outRid);
+  const Status endScan();
+
+ private:
+  int findKey(const char *key) const;
+  const Status readBitmap(const int v, WAHBitmap & bits);
+  const Status writeBitmap(const int v, const WAHBitmap & bits);
+  const Status writeDir();
+
+  File* file;                           // index file
+  int headerPageNo;                     // page # of header page
+  BitmapHdr* header;                    // pinned header page
+  bool dirDirty;                        // directory changed since read
+
+  Datatype type;                        // type of key
+  int keyLen;                           // length of key
+  int entryLen;                         // length of a directory entry
+
+  // directory: key and first bitmap page of each value
+  vector<char> keys;
+  vector<int> firstPage;
+
+  // state of the current scan
+  vector<int> scanPos;                  // positions of qualifying tuples
+  unsigned int scanNextPos;             // next element of scanPos
+};
+
+#endif
@@ -0,0 +1,114 @@
+#ifndef BTREE_H
+#define BTREE_H
+
+#include "index.h"
+#include "sort.h"
+
+
+// Header page of a B+-tree index file. It is the first page of the
+// file and stays pinned while the index is open.
+
+typedef struct {
+  int rootPageNo;                       // page # of root node
+  int height;                           // # of levels, 1 if root is a leaf
+  int attrType;                         // type of key
+  int keyLen;                           // length of key in bytes
+  int payloadLen;                       // length of included attributes
+  int entryCnt;                         // # of (key, RID) entries
+} BTreeHdr;
+
+
+// Nodes written by bulkLoad() are filled to this fraction of their
+// capacity, which leaves room for later inserts without splits.
+
+#define BTREELOADFILL  0.9
+
+
+// A node of the tree, one per page. Entries are kept sorted on
+// (key, RID), which makes every entry unique even if keys repeat.
+//
+// Leaves (level 0) hold (key, RID, payload) entries and are chained
+// from left to right through nextPage. The payload holds copies of
+// the included attributes of a covering index and is empty otherwise.
+//
+// Inner nodes hold firstChild followed by (key, RID, child) entries.
+// The (key, RID) of an entry is the smallest entry in the subtree of
+// its child; everything smaller is found under the child to its left.
+
+typedef struct {
+  int level;                            // 0 for leaves
+  int keyCnt;                           // # of entries in data[]
+  int nextPage;                         // right sibling of a leaf, or -1
+  int firstChild;                       // leftmost child of an inner node
+  char data[PAGESIZE - 4 * sizeof(int)];
+} BTreeNode;
+
+
+class BTreeIndex : public Index {
+ public:
+  // open the index in file name, creating an empty one if the file
+  // does not exist; leaf entries carry payloadLen bytes of included
+  // attributes
+  BTreeIndex(const string & name,
+	     const Datatype type,
+	     const int len,
+	     const int payloadLen,
+	     Status & status);
+  ~BTreeIndex();
+
+  const Status insertEntry(const void *value, const RID & rid);
+  const Status insertEntry(const void *value, const RID & rid,
+			   const char *payload);
+  const Status deleteEntry(const void *value, const RID & rid);
+
+  const Status startScan(const void *value, const Operator op);
+  const Status scanNext(RID & outRid);
+  const Status scanNext(RID & outRid, const char *& key,
+			const char *& payload);
+  const Status endScan();
+
+  // fill an empty index bottom-up from the records of sorted, which
+  // must come in (key, RID) order and hold a key followed by its RID
+  // and payload at keyOffset; nodes are filled to fill times their capacity
+  const Status bulkLoad(SortedFile & sorted, const int keyOffset,
+			const double fill);
+
+ private:
+  int keycmp(const char *k1, const char *k2) const;
+  int entrycmp(const char *entry, const char *key, const RID & rid) const;
+  int search(const BTreeNode *node, const char *key, const RID & rid,
+	     const bool upper) const;
+  int childAt(const BTreeNode *node, const int i) const;
+
+  char *entryAt(BTreeNode *node, const int i) const
+  {
+    return node->data + i * (node->level ? innerLen : leafLen);
+  }
+
+  const Status insertInto(const int pageNo, const char *key, const RID & rid,
+			  const char *payload, bool & split, char *sepEntry,
+			  int & newPageNo);
+  const Status findLeaf(const char *key, const RID & rid, int & pageNo,
+			BTreeNode *& node);
+
+  File* file;                           // index file
+  int headerPageNo;                     // page # of header page
+  BTreeHdr* header;                     // pinned header page
+  bool hdrDirty;
+
+  Datatype type;                        // type of key
+  int keyLen;                           // length of key
+  int payloadLen;                       // length of included attributes
+  int sepLen;                           // length of (key, RID)
+  int leafLen, innerLen;                // length of leaf/inner entries
+  int leafCap, innerCap;                // max. # of entries per node
+
+  // state of the current scan
+  BTreeNode* curNode;                   // pinned leaf, NULL if none
+  int curPageNo;
+  int curSlot;                          // next entry of curNode
+  Operator scanOp;
+  char* scanValue;                      // NULL if all entries qualify
+};
+
+#endif
@@ -136,6 +136,13 @@ public:
   {
 	bufStats.clear();
   }
+
+  const int getNumBufs() const // number of frames in the buffer pool
+  {
+	return numBufs;
+  }
+
+  const int getNumUnpinned() const; // # of frames no one has pinned
 };
 
 #endif
@@ -10,8 +10,12 @@
 
 #define RELCATNAME   "relcat"           // name of relation catalog
 #define ATTRCATNAME  "attrcat"          // name of attribute catalog
+#define STATCATNAME  "statcat"          // name of statistics catalog
+#define INDCATNAME   "indcat"           // name of index catalog
 #define MAXNAME      32                 // length of relName, attrName
 #define MAXSTRINGLEN 255                // max. length of string attribute
+#define RELCACHESIZE 113                // hash table size of relcat cache
+#define ATTRCACHESIZE 211               // hash table size of attrcat cache
 
 
 // schema of relation catalog:
@@ -25,6 +29,40 @@ typedef struct {
 } RelDesc;
 
 
+// declarations for the in-memory relation catalog cache. Every relcat
+// tuple is loaded into this hash table when the catalog is opened, so
+// that getInfo() never has to scan relcat.
+
+struct relCacheBucket
+{
+  RelDesc rd;                           // cached relcat tuple
+  RID rid;                              // location of the tuple in relcat
+  relCacheBucket* next;                 // next node in the hash table
+};
+
+
+class RelCacheTbl
+{
+private:
+  int HTSIZE;
+  relCacheBucket** ht;                  // actual hash table
+  int hash(const string & relation);    // returns value between 0 and HTSIZE-1
+
+public:
+  RelCacheTbl(const int htSize);        // constructor
+  ~RelCacheTbl();                       // destructor
+
+  // insert relcat tuple stored at rid; HASHTBLERROR if already cached
+  Status insert(const RelDesc & rd, const RID & rid);
+
+  // return cached tuple (and its rid) or HASHNOTFOUND
+  Status lookup(const string & relation, RelDesc & rd, RID & rid);
+
+  // remove relation from cache; HASHNOTFOUND if not cached
+  Status remove(const string & relation);
+};
+
+
 typedef struct {
   char relName[MAXNAME];                // relation name
   char attrName[MAXNAME];               // attribute name
@@ -61,6 +99,9 @@ class RelCatalog : public HeapFile {
 
   // get rid of catalog
   ~RelCatalog();
+
+ private:
+  RelCacheTbl cache;                    // all relcat tuples, keyed by name
 };
 
 
@@ -81,6 +122,58 @@ typedef struct {
 } AttrDesc;
 
 
+// declarations for the in-memory attribute catalog cache. Each attrcat
+// tuple is hashed on (relation, attribute); the tuples of a relation are
+// also linked together in attrcat (RID) order so that getRelInfo() can
+// return them in the same order a scan of attrcat would.
+
+struct attrCacheBucket
+{
+  AttrDesc ad;                          // cached attrcat tuple
+  RID rid;                              // location of the tuple in attrcat
+  attrCacheBucket* next;                // next node in the hash table
+  attrCacheBucket* relNext;             // next attribute of the same relation
+};
+
+
+struct relAttrBucket
+{
+  char relName[MAXNAME];                // relation name
+  int attrCnt;                          // number of attributes on the list
+  attrCacheBucket* first;               // attributes in attrcat order
+  relAttrBucket* next;                  // next node in the hash table
+};
+
+
+class AttrCacheTbl
+{
+private:
+  int HTSIZE;
+  attrCacheBucket** ht;                 // (relation, attribute) -> tuple
+  relAttrBucket** relHt;                // relation -> list of its tuples
+  int hash(const string & relation,
+	   const string & attrName);    // returns value between 0 and HTSIZE-1
+  relAttrBucket* findRel(const string & relation);
+
+public:
+  AttrCacheTbl(const int htSize);       // constructor
+  ~AttrCacheTbl();                      // destructor
+
+  // insert attrcat tuple stored at rid; HASHTBLERROR if already cached
+  Status insert(const AttrDesc & ad, const RID & rid);
+
+  // return cached tuple (and its rid) or HASHNOTFOUND
+  Status lookup(const string & relation, const string & attrName,
+		AttrDesc & ad, RID & rid);
+
+  // return a malloc'ed copy of all tuples of a relation or HASHNOTFOUND
+  Status lookupRel(const string & relation, int & attrCnt, AttrDesc *& attrs);
+
+  // remove attribute from cache; HASHNOTFOUND if not cached
+  Status remove(const string & relation, const string & attrName);
+};
+
+
 class AttrCatalog : public HeapFile {
  friend class RelCatalog;
 
@@ -109,11 +202,183 @@ class AttrCatalog : public HeapFile {
 
   // close attribute catalog
   ~AttrCatalog();
+
+ private:
+  AttrCacheTbl cache;                   // all attrcat tuples
+};
+
+
+// schema of statistics catalog:
+//   relation name : char(32)           <-- lookup keys
+//   attribute name : char(32)          <-- (empty for the relation row)
+//   page count : integer(4)
+//   tuple count : integer(4)
+//   distinct count : integer(4)
+//   attribute type : integer(4)
+//   bucket count : integer(4)
+//   min, max : char(STATVALLEN)        (binary attribute values)
+//   bucket bounds : char(STATVALLEN) * HISTBUCKETS
+//
+// ANALYZE writes one row per relation and one row per attribute.
+// The histogram is equi-depth: each of the bucketCnt buckets holds
+// about tupleCnt / bucketCnt tuples, and bounds[b] is the largest
+// value in bucket b. Only the first STATVALLEN bytes of a string
+// value are kept.
+
+#define HISTBUCKETS  10                 // max. # of histogram buckets
+#define STATVALLEN   16                 // bytes of a value kept in statcat
+
+typedef struct {
+  char relName[MAXNAME];                // relation name
+  char attrName[MAXNAME];               // attribute name, "" for relation
+  int pageCnt;                          // # of data pages of relation
+  int tupleCnt;                         // # of tuples of relation
+  int distinctCnt;                      // # of distinct attribute values
+  int attrType;                         // attribute type
+  int bucketCnt;                        // # of histogram buckets in use
+  char minVal[STATVALLEN];              // smallest attribute value
+  char maxVal[STATVALLEN];              // largest attribute value
+  char bounds[HISTBUCKETS][STATVALLEN]; // upper bound of each bucket
+} StatDesc;
+
+
+class StatCatalog : public HeapFile {
+ public:
+  // open statistics catalog
+  StatCatalog(Status &status);
+
+  // get statistics of a relation (attrName empty) or of an attribute
+  const Status getInfo(const string & relation,
+		       const string & attrName,
+		       StatDesc &record);
+
+  // add information to catalog
+  const Status addInfo(StatDesc & record);
+
+  // remove all statistics of a relation
+  const Status removeInfo(const string & relation);
+
+  // recompute statistics of a relation, or of all relations if empty
+  const Status analyze(const string & relation);
+
+  // estimates for query operators. These fall back on the heap file
+  // header and on default selectivities if the relation has not been
+  // analyzed.
+  const int pageCount(const string & relation);
+  const int tupleCount(const string & relation);
+  const int distinctCount(const AttrDesc & attr);
+
+  // fraction of tuples of attr's relation satisfying (attr op value);
+  // value is in binary form, NULL means no predicate
+  const double selectivity(const AttrDesc & attr,
+			   const Operator op,
+			   const char *value);
+
+  // close statistics catalog
+  ~StatCatalog();
+
+ private:
+  const Status analyzeRel(const string & relation);
+  const Status analyzeAttrs(const string & relation,
+			    const RelDesc & rd,
+			    const int attrCnt,
+			    const AttrDesc *attrs);
+
+  typedef struct {
+    StatDesc sd;                        // cached statcat tuple
+    RID rid;                            // location of the tuple in statcat
+  } STATENTRY;
+
+  vector<STATENTRY> cache;              // all statcat tuples
+};
+
+
+// schema of index catalog:
+//   relation name : char(32)           <-- lookup keys
+//   attribute name : char(32)          <--
+//   index type : integer(4)
+//   # of buckets : integer(4)          (initial # for a hash index)
+//   included attributes : char(64)     (comma-separated names)
+//
+// One tuple per index. There is at most one index per attribute; it
+// is stored in the file named by indexFileName() (index.h).
+//
+// A B+-tree can be declared with included attributes. Its leaves
+// then keep a copy of them next to the key, so that queries using
+// only the key and those attributes never read the relation.
+//
+// A bitmap index keeps one compressed bitmap of the tuples per
+// distinct key; it suits attributes with few distinct values.
+
+enum IndexType { BTREE, HASH, BITMAP };
+
+#define MAXINCLUDE   64                 // length of include list
+
+typedef struct {
+  char relName[MAXNAME];                // relation name
+  char attrName[MAXNAME];               // indexed attribute
+  int indexType;                        // IndexType
+  int nbuckets;                         // hash index: initial # of buckets
+  char include[MAXINCLUDE];             // included attributes, or ""
+} IndexDesc;
+
+
+class IndexCatalog : public HeapFile {
+ public:
+  // open index catalog
+  IndexCatalog(Status &status);
+
+  // get the index on an attribute; NOINDEX if there is none
+  const Status getInfo(const string & relation,
+		       const string & attrName,
+		       IndexDesc &record);
+
+  // get all indexes of a relation
+  const Status getRelInfo(const string & relation,
+			  vector<IndexDesc> & indexes);
+
+  // add information to catalog
+  const Status addInfo(IndexDesc & record);
+
+  // remove tuple from catalog
+  const Status removeInfo(const string & relation, const string & attrName);
+
+  // create an index on an attribute and fill it from the relation;
+  // nbuckets is the initial # of buckets of a hash index, include
+  // the attributes a B+-tree covers besides the key
+  const Status buildIndex(const string & relation,
+			  const string & attrName,
+			  const IndexType type,
+			  const int nbuckets,
+			  const vector<string> & include);
+
+  // replace the index on an attribute, if any, by a new one
+  const Status rebuildIndex(const string & relation,
+			    const string & attrName,
+			    const IndexType type,
+			    const int nbuckets);
+
+  // drop the index on an attribute, or all indexes of the relation
+  // if attrName is empty
+  const Status dropIndex(const string & relation, const string & attrName);
+
+  // close index catalog
+  ~IndexCatalog();
+
+ private:
+  typedef struct {
+    IndexDesc id;                       // cached indcat tuple
+    RID rid;                            // location of the tuple in indcat
+  } INDEXENTRY;
+
+  vector<INDEXENTRY> cache;             // all indcat tuples
 };
 
 
 extern RelCatalog  *relCat;
 extern AttrCatalog *attrCat;
+extern StatCatalog *statCat;
+extern IndexCatalog *indCat;
 extern Error error;
 extern Status createHeapFile(const string filename);
 extern Status destroyHeapFile(const string filename);
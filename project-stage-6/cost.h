@@ -0,0 +1,82 @@
+#ifndef COST_H
+#define COST_H
+
+#include "catalog.h"
+#include "query.h"
+
+
+// Cost estimates of the join methods, in page I/Os (page reads plus
+// page writes). Relation sizes come from statcat when the relations
+// have been analyzed, and from their heap file headers otherwise.
+
+typedef struct {
+  int outerPages, innerPages;           // size of outer/inner relation
+  int outerTuples, innerTuples;
+  double resultTuples;                  // estimated result cardinality
+  double resultPages;                   // pages written for the result
+  int bufs;                             // usable buffer pool frames
+  double probePages;                    // index pages read by one probe of
+                                        // the inner relation, < 0 if the
+                                        // inner attribute has no index
+  double indexPages;                    // size of that index
+} JOINSTATS;
+
+
+// collect the inputs of the cost formulas for attr1 op attr2
+void QU_JoinStats(const AttrDesc & attrDesc1,
+		  const Operator op,
+		  const AttrDesc & attrDesc2,
+		  const int resultLen,
+		  JOINSTATS & js);
+
+// estimated cost of a join method; negative if the method cannot
+// evaluate the join (e.g. sort-merge join of a non-equijoin)
+const double QU_JoinCost(const JoinType method, const Operator op,
+			 const JOINSTATS & js);
+
+// cheapest join method that can evaluate the join
+const JoinType QU_ChooseJoin(const Operator op, const JOINSTATS & js);
+
+// name of a join method for log output
+const char *QU_JoinName(const JoinType method);
+
+
+// Cost estimates of a selection (attr op value), in page I/Os: a
+// scan of the heap file, or an index scan that fetches the matching
+// tuples in page order. value is in binary form.
+
+const double QU_ScanSelectCost(const AttrDesc & attr);
+
+// negative if the index cannot evaluate the predicate
+const double QU_IndexSelectCost(const AttrDesc & attr,
+				const IndexDesc & id,
+				const Operator op,
+				const char *value);
+
+// cost of answering a selection (attr op value) from the covering
+// B+-tree id on key alone; attr is NULL if there is no predicate
+const double QU_IndexOnlyCost(const AttrDesc & key,
+			      const IndexDesc & id,
+			      const AttrDesc *attr,
+			      const Operator op,
+			      const char *value);
+
+// true if a selection of the projected attributes with predicate
+// (attr op value) should be answered from the covering index returned
+// in id alone
+const bool QU_ChooseCovering(const string & relation,
+			     const int projCnt,
+			     const AttrDesc projNames[],
+			     const AttrDesc *attr,
+			     const Operator op,
+			     const char *value,
+			     IndexDesc & id);
+
+// true if (attr op value) should be evaluated with the index on attr,
+// which is returned in id
+const bool QU_ChooseIndex(const AttrDesc & attr,
+			  const Operator op,
+			  const char *value,
+			  IndexDesc & id);
+
+#endif
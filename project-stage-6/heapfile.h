@@ -58,6 +58,9 @@ public:
   // return number of records in file
   const int getRecCnt() const;
 
+  // return number of data pages in file
+  const int getPageCnt() const;
+
   // given a RID, read record from file, returning pointer and length
   const Status getRecord(const RID &rid, Record & rec);
 };
@@ -81,6 +84,8 @@ public:
     const Status endScan(); // terminate the scan
     const Status markScan(); // save current position of scan
     const Status resetScan(); // reset scan to last marked location
+    // position scan on record rid; scanNext() continues after it
+    const Status positionScan(const RID & rid);
 
     // return RID of next record that satisfies the scan 
     const Status scanNext(RID& outRid);
@@ -94,12 +99,21 @@ public:
     // marks current page of scan dirty
     const Status markDirty();
 
+    // Test every record the filter of startScan() passes with pred
+    // as well, skipping it if pred returns false; NULL turns the test
+    // off. A join pushes a Bloom filter on its probe side into the
+    // scan this way. startScan() leaves pred in place.
+    void setRecFilter(const bool (*pred)(const Record & rec, void *arg),
+                      void *arg = NULL);
+
 private:
     int   offset;            // byte offset of filter attribute
     int   length;            // length of filter attribute
     Datatype type;           // datatype of filter attribute
     const char* filter;      // comparison value of filter
     Operator op;             // comparison operator of filter
+    const bool (*recFilter)(const Record & rec, void *arg);
+    void* recFilterArg;      // passed to recFilter
 
      // The following variables are used to preserve the state
     // of the scan when the method markScan() is invoked.
@@ -109,6 +123,7 @@ private:
     RID   markedRec;         // rid of last record returned
 
     const bool matchRec(const Record & rec) const;
+    const bool acceptRec(const Record & rec) const;
 };
 
 
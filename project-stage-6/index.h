@@ -0,0 +1,95 @@
+#ifndef INDEX_H
+#define INDEX_H
+
+#include "catalog.h"
+
+
+// define if debug output wanted
+//#define DEBUGIND
+
+
+// An index maps attribute values (keys) to the RIDs of the tuples
+// holding them. Every index type implements this interface; the
+// query layer only talks to an index through it.
+//
+// A scan returns the RIDs of all entries satisfying (key op value).
+// A NULL value scans all entries. scanNext() returns NOMORERECS
+// after the last matching entry. Index types that cannot evaluate
+// an operator reject it in startScan() with BADINDEXPARM.
+
+class Index {
+ public:
+  virtual ~Index() {}
+
+  // add/remove the entry (value, rid)
+  virtual const Status insertEntry(const void *value, const RID & rid) = 0;
+  virtual const Status deleteEntry(const void *value, const RID & rid) = 0;
+
+  virtual const Status startScan(const void *value, const Operator op) = 0;
+  virtual const Status scanNext(RID & outRid) = 0;
+  virtual const Status endScan() = 0;
+};
+
+
+// copy a value into a key of len bytes; a string value shorter than
+// the attribute is padded with null bytes
+void indexKey(const void *value, const Datatype type, const int len,
+	      char *key);
+
+// compare two keys; returns < 0, 0, or > 0 like strcmp
+int indexKeycmp(const char *k1, const char *k2, const Datatype type,
+		const int len);
+
+// true if an index of the given type can evaluate (key op value)
+const bool indexCanEval(const IndexType type, const Operator op);
+
+// name of the file holding the index on relation.attrName
+const string indexFileName(const string & relation, const string & attrName);
+
+// open the index described by an indcat tuple
+const Status openIndex(const IndexDesc & id, const AttrDesc & attr,
+		       Index *& index);
+
+// look up the attributes included in an index; empty if none
+const Status indexIncludes(const IndexDesc & id, vector<AttrDesc> & include);
+
+// total length of included attributes
+const int indexPayloadLen(const vector<AttrDesc> & include);
+
+// copy the included attributes of a tuple into payload
+void indexPayload(const Record & rec, const vector<AttrDesc> & include,
+		  char *payload);
+
+// compare two RIDs in page order; for qsort(3)
+int ridcmp(const void *p1, const void *p2);
+
+// scan an index for (key op value) and return the RIDs found, sorted
+// in page order so that the tuples can be fetched reading each heap
+// page once
+const Status indexLookup(const IndexDesc & id, const AttrDesc & attr,
+			 const void *value, const Operator op,
+			 vector<RID> & rids);
+
+
+// The indexes of one relation, opened together so that insert,
+// delete and load can keep all of them up to date with the heap file.
+
+class RelIndexes {
+ public:
+  RelIndexes(const string & relation, Status & status);
+  ~RelIndexes();
+
+  // add/remove the entries of a tuple stored at rid to/from every index
+  const Status insertEntries(const Record & rec, const RID & rid);
+  const Status deleteEntries(const Record & rec, const RID & rid);
+
+  // true if the relation has no indexes
+  const bool empty() const { return indexes.empty(); }
+
+ private:
+  vector<Index*> indexes;               // open indexes
+  vector<AttrDesc> attrs;               // indexed attribute of each
+  vector<vector<AttrDesc> > includes;   // included attributes of each
+};
+
+#endif
@@ -1,40 +1,115 @@
+#ifndef JOINHT_H
+#define JOINHT_H
+
+#include "catalog.h"
+
+
+// Hash of a join attribute value, computed with MurmurHash3 over the
+// bytes of the value. A string is hashed up to its first null byte,
+// since strings compare equal up to there. Different seeds give
+// independent hash functions.
+
+unsigned int joinHash(const char *value, const AttrDesc & attr,
+		      const unsigned int seed);
+
+
+// In-memory hash table on the join attribute of the outer (build)
+// tuples of a hash join. An entry holds the join value, the RID of the
+// tuple and dataLen bytes the caller copies in, e.g. the projected
+// attributes of the tuple, so that a probe needs no I/O.
+//
+// Entries are carved out of large arena blocks and chained from a
+// power-of-two array of buckets. They are never freed one at a time:
+// the whole arena goes with the table. A probe walks the chain with an
+// iterator and allocates nothing.
 
 class joinHashTbl
 {
 private:
-    union JAttrType
-    {
-	int iValue;
-	float fValue;
-	char* sValue;
-    };
-	
     struct joinhashBucket
     {
-	union JAttrType	attrValue;
-       	RID	rid;
-       	joinhashBucket*     next;    // next node in the hash table
-    };
-
-    struct HTentry
-    {
-	int bucketCnt;  // nuumber of buckets on this chain
-	joinhashBucket*   chain;  // pointer to first bucket on the chain
+	joinhashBucket*	next;    // next entry on the chain
+	unsigned int	hashValue;  // full hash of the join value
+	RID		rid;
+	// followed by the join value and the data of the entry
     };
 
     AttrDesc 	joinAttr;
-    int 	HTSIZE;
-    HTentry 	*ht; // actual hash table
-    int  hash(const char* attr, int attrType); // returns value between 0 and HTSIZE-1
+    int 	HTSIZE;             // # of chains, a power of two
+    int 	dataLen;            // bytes of data per entry
+    int 	entryLen;           // bytes per entry, aligned
+    joinhashBucket** ht;            // actual hash table
+
+    vector<char*> arena;            // blocks entries are carved from
+    char*	arenaNext;          // next free byte of the last block
+    int 	arenaFree;          // bytes left in the last block
+
+    const char* value(const joinhashBucket* b) const
+	{ return (const char*) (b + 1); }
+    const bool match(const joinhashBucket* b, const unsigned int h,
+		     const char* attrPtr) const;
 
 public:
-    joinHashTbl(const int size, const AttrDesc attr);  // constructor
+    joinHashTbl(const int size, const AttrDesc attr, const int dataLen = 0);
     ~joinHashTbl();
 
-     // insert a new (JoinAttrValue, RID) pair into hash table
-     Status insert(const RID newRid,  const char* tuple);
+    // Matches of a probe value; next() moves to the first/next match.
+    class iterator
+    {
+    public:
+	iterator() : tbl(NULL), cur(NULL) {}
+	const bool next();
+	const RID & rid() const { return cur->rid; }
+	const char* data() const { return tbl->value(cur) + tbl->joinAttr.attrLen; }
+    private:
+	friend class joinHashTbl;
+	const joinHashTbl* tbl;
+	const joinhashBucket* cur;      // current match, or NULL
+	const joinhashBucket* chain;    // chain before the first next()
+	unsigned int hashValue;
+	const char* attrPtr;            // probe value
+    };
+
+    // insert an entry for the tuple at tuple, copying dataLen bytes of
+    // data into it
+    Status insert(const RID newRid, const char* tuple, const char* data = NULL);
+
+    // start an iteration over the entries whose join attribute value
+    // matches innerJoinAttrPtr
+    void lookup(const char* innerJoinAttrPtr, iterator & it) const;
+};
+
+
+// Bloom filter on join attribute values: a bit array in which add()
+// sets BLOOMHASHES bits chosen by hashing a value. mayContain() is
+// true for every value added, and false for all but a share of about
+// 1% of the others, so a join can drop most probe tuples that have no
+// match before partitioning, sorting or probing them.
+//
+// The filter is blocked: all bits of a value fall into one block of
+// BLOOMBLOCK bits, a cache line, picked by a hash of the value, and
+// the bits in the block are picked by double hashing. A test thus
+// costs one hash and at most one cache miss. About BLOOMBITS bits are
+// used per expected value, rounded up to a power of two.
+
+#define BLOOMBITS    10
+#define BLOOMHASHES  7
+#define BLOOMBLOCK   512
+
+class BloomFilter
+{
+private:
+    AttrDesc 	attr;               // type and length of the values
+    vector<unsigned int> bits;
+    unsigned int blockMask;         // # of blocks - 1
+
+    const int block(const char* value, unsigned int & h) const;
+
+public:
+    BloomFilter(const int keyCnt, const AttrDesc attr);
 
-     // get RIDs of records whose join attribute value matches innerJoinAttrValue
-     Status lookup(const char* innerJoinAttrPtr, int & ridCount, RID *&outRids);
+    void add(const char* value);
+    const bool mayContain(const char* value) const;
 };
 
+#endif
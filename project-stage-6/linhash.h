@@ -0,0 +1,102 @@
+#ifndef LINHASH_H
+#define LINHASH_H
+
+#include "index.h"
+
+
+// A bucket is split once the index holds more than this fraction of
+// the entries its primary bucket pages can hold.
+
+#define LHASHFILL  0.8
+
+
+// Header page of a linear hash index file. It is the first page of
+// the file and stays pinned while the index is open.
+//
+// The index starts with initBuckets buckets. Buckets are split one at
+// a time, in order: bucket next is split into next and next +
+// initBuckets * 2^level. Once every bucket of a round has been split,
+// level goes up by one and next starts over at 0.
+
+typedef struct {
+  int attrType;                         // type of key
+  int keyLen;                           // length of key in bytes
+  int initBuckets;                      // # of buckets of round 0
+  int level;                            // current round
+  int next;                             // next bucket to split
+  int entryCnt;                         // # of (key, RID) entries
+  int dirPageNo;                        // first directory page
+} LHashHdr;
+
+
+// Directory page: the page # of the primary page of each bucket.
+// Directory pages are chained; page d holds buckets d * LHASHDIRSIZE
+// to (d + 1) * LHASHDIRSIZE - 1.
+
+#define LHASHDIRSIZE  (int)(PAGESIZE / sizeof(int) - 1)
+
+typedef struct {
+  int nextDir;                          // next directory page, or -1
+  int pageNo[LHASHDIRSIZE];             // primary page of each bucket
+} LHashDir;
+
+
+// Bucket page holding (key, RID) entries. The primary page of a
+// bucket is followed by a chain of overflow pages.
+
+typedef struct {
+  int entryCnt;                         // # of entries in data[]
+  int overflow;                         // next page of bucket, or -1
+  char data[PAGESIZE - 2 * sizeof(int)];
+} LHashPage;
+
+
+class LinearHashIndex : public Index {
+ public:
+  // open the index in file name, creating one with nbuckets (empty)
+  // buckets if the file does not exist
+  LinearHashIndex(const string & name,
+		  const Datatype type,
+		  const int len,
+		  const int nbuckets,
+		  Status & status);
+  ~LinearHashIndex();
+
+  const Status insertEntry(const void *value, const RID & rid);
+  const Status deleteEntry(const void *value, const RID & rid);
+
+  // only equality scans (and scans of all entries) are supported
+  const Status startScan(const void *value, const Operator op);
+  const Status scanNext(RID & outRid);
+  const Status endScan();
+
+ private:
+  const int bucketCnt() const
+  {
+    return (header->initBuckets << header->level) + header->next;
+  }
+  int bucketOf(const char *key) const;
+  const Status bucketPage(const int bucket, int & pageNo);
+  const Status addBucket(const int bucket, int & pageNo);
+  const Status addToBucket(const int bucket, const char *entry);
+  const Status split();
+
+  File* file;                           // index file
+  int headerPageNo;                     // page # of header page
+  LHashHdr* header;                     // pinned header page
+  bool hdrDirty;
+
+  Datatype type;                        // type of key
+  int keyLen;                           // length of key
+  int entryLen;                         // length of an entry
+  int pageCap;                          // max. # of entries per page
+
+  // state of the current scan
+  LHashPage* curPage;                   // pinned bucket page, NULL if none
+  int curPageNo;
+  int curSlot;                          // next entry of curPage
+  int curBucket;                        // bucket being scanned
+  char* scanValue;                      // NULL if all entries qualify
+};
+
+#endif
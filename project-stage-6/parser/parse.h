@@ -57,8 +57,11 @@ typedef enum {
     N_LOAD,
     N_PRINT,
     N_HELP,
+    N_ANALYZE,
     N_SELECT,
     N_JOIN,
+    N_COND,
+    N_ORDER,
     N_PRIMATTR,
     N_QUALATTR,
     N_ATTRVAL,
@@ -82,6 +85,7 @@ typedef struct node {
 	    char *relname;
 	    struct node *attrlist;
 	    struct node *qual;
+	    struct node *order;		// order node, or NULL
 	} QUERY;
 
 	// insert node */
@@ -113,6 +117,8 @@ typedef struct node {
 	    char *relname;
 	    char *attrname;
 	    int nbuckets;
+	    struct node *include;	// list of attrval nodes, or NULL
+	    int bitmap;			// build a bitmap index
 	} BUILD;
 
 	// drop node */
@@ -137,6 +143,11 @@ typedef struct node {
 	    char *relname;
 	} HELP;
 
+	// analyze node */
+	struct {
+	    char *relname;
+	} ANALYZE;
+
 	// select node */
 	struct {
 	    struct node *selattr;
@@ -151,6 +162,19 @@ typedef struct node {
 	    struct node *joinattr2;
 	} JOIN;
 
+	// and/or of two selections */
+	struct {
+	    int op;			// RW_AND or RW_OR
+	    struct node *left;
+	    struct node *right;
+	} COND;
+
+	// order by node */
+	struct {
+	    struct node *attr;		// qualattr node
+	    int limit;			// max. # of tuples, or -1
+	} ORDER;
+
 	// qualified attribute node */
 	struct {
 	    char *relname;
@@ -212,19 +236,23 @@ typedef struct node {
 //
 
 NODE *newnode(int kind);
-NODE *query_node(char *relname, NODE *attrlist, NODE *n);
+NODE *query_node(char *relname, NODE *attrlist, NODE *n, NODE *order);
 NODE *insert_node(char *relname, NODE *attrlist);
 NODE *delete_node(char *relname, NODE *qual);
 NODE *create_node(char *relname, NODE *attrlist, NODE *primattr);
 NODE *destroy_node(char *relname);
-NODE *build_node(char *relname, char *attrname, int nbuckets);
+NODE *build_node(char *relname, char *attrname, int nbuckets,
+		 NODE *include, int bitmap);
 NODE *rebuild_node(char *relname, char *attrname, int nbuckets);
 NODE *drop_node(char *relname, char *attrname);
 NODE *load_node(char *relname, char *filename);
 NODE *print_node(char *relname);
 NODE *help_node(char *relname);
+NODE *analyze_node(char *relname);
 NODE *select_node(NODE *selattr, int op, NODE *value);
 NODE *join_node(NODE *joinattr1, int op, NODE *joinattr2);
+NODE *cond_node(int op, NODE *left, NODE *right);
+NODE *order_node(NODE *attr, int limit);
 NODE *qualattr_node(char *relname, char *attrname);
 NODE *primattr_node(char *attrname, int nbuckets);
 NODE *attrval_node(char *attrname, NODE *value);
@@ -35,6 +35,7 @@ static NODE *parse_tree;                // root of parse tree
 		RW_PRINT
 		RW_LOAD
 		RW_HELP
+		RW_ANALYZE
 		RW_QUIT
 		RW_SELECT
 		RW_INTO
@@ -51,6 +52,11 @@ static NODE *parse_tree;                // root of parse tree
 		RW_OR
 		RW_NOT
 		RW_VALUES	
+		RW_INCLUDE
+		RW_BITMAP
+		RW_ORDER
+		RW_BY
+		RW_LIMIT
 		INT_TYPE
 		REAL_TYPE
 		CHAR_TYPE	
@@ -73,6 +79,7 @@ static NODE *parse_tree;                // root of parse tree
 		T_SHELL_CMD
 
 %type	<ival>	op
+		opt_limit
 
 %type	<sval>	opt_into_relname
 		opt_relname
@@ -85,17 +92,21 @@ static NODE *parse_tree;                // root of parse tree
 		create
 		destroy
 		build
-/*
 		rebuild
-*/
 		drop
 		load
 		print
 		help
+		analyze
 		quit
 		opt_primary_attr
+		opt_include
 		opt_where
+		opt_order
 		qual
+		condition
+		conjunct
+		factor
 		selection
 		join
 		non_mt_qualattr_list
@@ -148,13 +159,12 @@ command
 	| create
 	| destroy
 	| build
-/*
 	| rebuild
-*/
 	| drop
 	| load
 	| print
 	| help
+	| analyze
 	| quit
 	| nothing
 	{
@@ -163,21 +173,30 @@ command
 	;
 
 query
-	: RW_SELECT non_mt_qualattr_list opt_into_relname RW_FROM table_list opt_where
+	: RW_SELECT non_mt_qualattr_list opt_into_relname RW_FROM table_list opt_where opt_order
 /*	RW_SELECT opt_into_relname '(' non_mt_qualattr_list ')' opt_where */
 	{
 		NODE *where;
+		NODE *order_list = NULL;
 		NODE *qualattr_list = replace_alias_in_qualattr_list($5, $2);
+		if ($7 != NULL)
+		  order_list = replace_alias_in_qualattr_list($5,
+					list_node($7->u.ORDER.attr));
 		if (qualattr_list == NULL) { // something wrong in qualattr_list
 		  $$ = NULL;
 		}
+		else if ($7 != NULL && order_list == NULL) {
+		  $$ = NULL; // something wrong in order by attribute
+		}
 		else {
 		  where = replace_alias_in_condition($5, $6);
 		  if ((where == NULL) && ($6 != NULL)) {
 		     $$ = NULL; //something wrong in where condition
 		  }
 		  else {
-		    $$ = query_node($3, qualattr_list, where);
+		    if ($7 != NULL)
+		      $7->u.ORDER.attr = order_list->u.LIST.self;
+		    $$ = query_node($3, qualattr_list, where, $7);
 		  }
 		}
 	}
@@ -270,20 +289,22 @@ destroy
 	;
 
 build
-	: RW_BUILD string '(' string ')'
+	: RW_BUILD string '(' string ')' opt_include
+	{
+		$$ = build_node($2, $4, 0, $6, 0);
+	}
+	| RW_BUILD string '(' string ')' RW_BITMAP
 	{
-		$$ = build_node($2, $4, 0);
+		$$ = build_node($2, $4, 0, NULL, 1);
 	}
 	;
 
-/*
 rebuild
 	: RW_REBUILD string '(' string ')' RW_NUMBUCKETS T_EQ T_INT
 	{
 		$$ = rebuild_node($2, $4, $8);
 	}
 	;
-*/
 
 drop
 	: RW_DROP string '(' string ')'
@@ -316,6 +337,13 @@ help
 	}
 	;
 
+analyze
+	: RW_ANALYZE opt_relname
+	{
+		$$ = analyze_node($2);
+	}
+	;
+
 quit
 	: RW_QUIT ';'
 	{
@@ -334,6 +362,17 @@ opt_primary_attr
 	}
 	;
 
+opt_include
+	: RW_INCLUDE '(' attrib_list ')'
+	{
+		$$ = $3;
+	}
+	| nothing
+	{
+		$$ = NULL;
+	}
+	;
+
 opt_into_relname
 	: RW_INTO string
 	{
@@ -367,11 +406,57 @@ opt_where
 	}
 	;
 
+opt_order
+	: RW_ORDER RW_BY qualattr opt_limit
+	{
+		$$ = order_node($3, $4);
+	}
+	| nothing
+	{
+		$$ = NULL;
+	}
+	;
+
+opt_limit
+	: RW_LIMIT T_INT
+	{
+		$$ = $2;
+	}
+	| nothing
+	{
+		$$ = -1;
+	}
+	;
+
 qual
-	: selection
+	: condition
 	| join
 	;
 
+condition
+	: condition RW_OR conjunct
+	{
+		$$ = cond_node(RW_OR, $1, $3);
+	}
+	| conjunct
+	;
+
+conjunct
+	: conjunct RW_AND factor
+	{
+		$$ = cond_node(RW_AND, $1, $3);
+	}
+	| factor
+	;
+
+factor
+	: selection
+	| '(' condition ')'
+	{
+		$$ = $2;
+	}
+	;
+
 selection
 	: qualattr op value
 	{
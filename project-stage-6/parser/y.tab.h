@@ -62,38 +62,44 @@ extern int yydebug;
     RW_PRINT = 263,                /* RW_PRINT  */
     RW_LOAD = 264,                 /* RW_LOAD  */
     RW_HELP = 265,                 /* RW_HELP  */
-    RW_QUIT = 266,                 /* RW_QUIT  */
-    RW_SELECT = 267,               /* RW_SELECT  */
-    RW_INTO = 268,                 /* RW_INTO  */
-    RW_WHERE = 269,                /* RW_WHERE  */
-    RW_INSERT = 270,               /* RW_INSERT  */
-    RW_DELETE = 271,               /* RW_DELETE  */
-    RW_PRIMARY = 272,              /* RW_PRIMARY  */
-    RW_NUMBUCKETS = 273,           /* RW_NUMBUCKETS  */
-    RW_ALL = 274,                  /* RW_ALL  */
-    RW_FROM = 275,                 /* RW_FROM  */
-    RW_AS = 276,                   /* RW_AS  */
-    RW_TABLE = 277,                /* RW_TABLE  */
-    RW_AND = 278,                  /* RW_AND  */
-    RW_OR = 279,                   /* RW_OR  */
-    RW_NOT = 280,                  /* RW_NOT  */
-    RW_VALUES = 281,               /* RW_VALUES  */
-    INT_TYPE = 282,                /* INT_TYPE  */
-    REAL_TYPE = 283,               /* REAL_TYPE  */
-    CHAR_TYPE = 284,               /* CHAR_TYPE  */
-    T_EQ = 285,                    /* T_EQ  */
-    T_LT = 286,                    /* T_LT  */
-    T_LE = 287,                    /* T_LE  */
-    T_GT = 288,                    /* T_GT  */
-    T_GE = 289,                    /* T_GE  */
-    T_NE = 290,                    /* T_NE  */
-    T_EOF = 291,                   /* T_EOF  */
-    NOTOKEN = 292,                 /* NOTOKEN  */
-    T_INT = 293,                   /* T_INT  */
-    T_REAL = 294,                  /* T_REAL  */
-    T_STRING = 295,                /* T_STRING  */
-    T_QSTRING = 296,               /* T_QSTRING  */
-    T_SHELL_CMD = 297              /* T_SHELL_CMD  */
+    RW_ANALYZE = 266,              /* RW_ANALYZE  */
+    RW_QUIT = 267,                 /* RW_QUIT  */
+    RW_SELECT = 268,               /* RW_SELECT  */
+    RW_INTO = 269,                 /* RW_INTO  */
+    RW_WHERE = 270,                /* RW_WHERE  */
+    RW_INSERT = 271,               /* RW_INSERT  */
+    RW_DELETE = 272,               /* RW_DELETE  */
+    RW_PRIMARY = 273,              /* RW_PRIMARY  */
+    RW_NUMBUCKETS = 274,           /* RW_NUMBUCKETS  */
+    RW_ALL = 275,                  /* RW_ALL  */
+    RW_FROM = 276,                 /* RW_FROM  */
+    RW_AS = 277,                   /* RW_AS  */
+    RW_TABLE = 278,                /* RW_TABLE  */
+    RW_AND = 279,                  /* RW_AND  */
+    RW_OR = 280,                   /* RW_OR  */
+    RW_NOT = 281,                  /* RW_NOT  */
+    RW_VALUES = 282,               /* RW_VALUES  */
+    RW_INCLUDE = 283,              /* RW_INCLUDE  */
+    RW_BITMAP = 284,               /* RW_BITMAP  */
+    RW_ORDER = 285,                /* RW_ORDER  */
+    RW_BY = 286,                   /* RW_BY  */
+    RW_LIMIT = 287,                /* RW_LIMIT  */
+    INT_TYPE = 288,                /* INT_TYPE  */
+    REAL_TYPE = 289,               /* REAL_TYPE  */
+    CHAR_TYPE = 290,               /* CHAR_TYPE  */
+    T_EQ = 291,                    /* T_EQ  */
+    T_LT = 292,                    /* T_LT  */
+    T_LE = 293,                    /* T_LE  */
+    T_GT = 294,                    /* T_GT  */
+    T_GE = 295,                    /* T_GE  */
+    T_NE = 296,                    /* T_NE  */
+    T_EOF = 297,                   /* T_EOF  */
+    NOTOKEN = 298,                 /* NOTOKEN  */
+    T_INT = 299,                   /* T_INT  */
+    T_REAL = 300,                  /* T_REAL  */
+    T_STRING = 301,                /* T_STRING  */
+    T_QSTRING = 302,               /* T_QSTRING  */
+    T_SHELL_CMD = 303              /* T_SHELL_CMD  */
   };
   typedef enum yytokentype yytoken_kind_t;
 #endif
@@ -110,38 +116,44 @@ extern int yydebug;
 #define RW_PRINT 263
 #define RW_LOAD 264
 #define RW_HELP 265
-#define RW_QUIT 266
-#define RW_SELECT 267
-#define RW_INTO 268
-#define RW_WHERE 269
-#define RW_INSERT 270
-#define RW_DELETE 271
-#define RW_PRIMARY 272
-#define RW_NUMBUCKETS 273
-#define RW_ALL 274
-#define RW_FROM 275
-#define RW_AS 276
-#define RW_TABLE 277
-#define RW_AND 278
-#define RW_OR 279
-#define RW_NOT 280
-#define RW_VALUES 281
-#define INT_TYPE 282
-#define REAL_TYPE 283
-#define CHAR_TYPE 284
-#define T_EQ 285
-#define T_LT 286
-#define T_LE 287
-#define T_GT 288
-#define T_GE 289
-#define T_NE 290
-#define T_EOF 291
-#define NOTOKEN 292
-#define T_INT 293
-#define T_REAL 294
-#define T_STRING 295
-#define T_QSTRING 296
-#define T_SHELL_CMD 297
+#define RW_ANALYZE 266
+#define RW_QUIT 267
+#define RW_SELECT 268
+#define RW_INTO 269
+#define RW_WHERE 270
+#define RW_INSERT 271
+#define RW_DELETE 272
+#define RW_PRIMARY 273
+#define RW_NUMBUCKETS 274
+#define RW_ALL 275
+#define RW_FROM 276
+#define RW_AS 277
+#define RW_TABLE 278
+#define RW_AND 279
+#define RW_OR 280
+#define RW_NOT 281
+#define RW_VALUES 282
+#define RW_INCLUDE 283
+#define RW_BITMAP 284
+#define RW_ORDER 285
+#define RW_BY 286
+#define RW_LIMIT 287
+#define INT_TYPE 288
+#define REAL_TYPE 289
+#define CHAR_TYPE 290
+#define T_EQ 291
+#define T_LT 292
+#define T_LE 293
+#define T_GT 294
+#define T_GE 295
+#define T_NE 296
+#define T_EOF 297
+#define NOTOKEN 298
+#define T_INT 299
+#define T_REAL 300
+#define T_STRING 301
+#define T_QSTRING 302
+#define T_SHELL_CMD 303
 
 /* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
@@ -154,7 +166,7 @@ union YYSTYPE
   char *sval;
   NODE *n;
 
-#line 158 "y.tab.h"
+#line 170 "y.tab.h"
 
 };
 typedef union YYSTYPE YYSTYPE;
@@ -17,13 +17,18 @@ class Partition {
 				 const int P),  
 	                               // hash function to use in partitioning
 	    string* &partName,           // names of partitioned heap files
-	    Status &status);            // create partitions of file
+	    Status &status,             // create partitions of file
+	    const Status (*keep)(const Record & rec,
+				 void *arg) = NULL,
+	                               // takes the records of partition 0
+	    void *arg = NULL);          // passed to keep
   ~Partition();                         // destroy partitions
 
  private:
 
   int P;                                // number of partitions
   string *partName;                      // partition names
+  bool keepFirst;                       // partition 0 has no file
 };
 
 #endif
@@ -3,7 +3,21 @@
 
 #include "heapfile.h"
 
-enum JoinType {NLJoin, SMJoin, HashJoin};
+enum JoinType {NLJoin, SMJoin, HashJoin, GraceJoin, HybridJoin, ParallelJoin,
+               AutoJoin};
+
+// A where clause of selections (attr op value) combined with and/or.
+// A leaf holds one selection, an and/or node its two operands.
+
+enum PredKind {PredLeaf, PredAnd, PredOr};
+
+typedef struct Predicate {
+  PredKind kind;
+  attrInfo attr;                        // leaf: attribute and value
+  Operator op;                          // leaf: comparison
+  struct Predicate *left;               // and/or: operands
+  struct Predicate *right;
+} Predicate;
 
 //
 // Prototypes for query layer functions
@@ -17,6 +31,11 @@ const Status QU_Select(const string & result,
 		       const Operator op, 
 		       const char *attrValue);
 
+const Status QU_SelectWhere(const string & result, 
+			    const int projCnt, 
+			    const attrInfo projNames[],
+			    const Predicate *pred);
+
 const Status QU_Join(const string & result, 
 		     const int projCnt, 
 		     const attrInfo projNames[],
@@ -24,6 +43,18 @@ const Status QU_Join(const string & result,
 		     const Operator op, 
 		     const attrInfo *attr2);
 
+// create relation source with the layout of result, for the tuples
+// of a query with ORDER BY
+const Status QU_OrderStart(const string & result, 
+			   const string & source);
+
+// insert the tuples of source into result in the order of attr,
+// only the first limit of them if limit >= 0
+const Status QU_OrderBy(const string & source, 
+			const string & result, 
+			const attrInfo *attr, 
+			const int limit);
+
 const Status QU_Insert(const string & relation, 
 		       const int attrCnt, 
 		       const attrInfo attrList[]);
@@ -7,24 +7,70 @@
 //#define DEBUGSORT
 
 
-// SORTREC is an in-memory sort record that qsort(3) sorts.
-// The sort attribute as well as the associated RID are
-// stored in the record. The RID is used for fetching the
-// full record when it is needed.
+// Buffer frames left unpinned for the caller while a SortedFile
+// merges its runs, e.g. for the result relation of a join.
+
+#define SORTRESERVE 8
+
+
+// With parallel merging, every SORTFENCE-th record of a run is kept
+// in memory as a fence (see SortedFile::addFence()).
+
+#define SORTFENCE 64
+
+
+// SORTREC is an in-memory sort record that generateRun() sorts.
+// The sort attribute, normalized by sortNormalize(), as well as
+// the associated RID are stored in the record. The RID is used
+// for fetching the full record when it is needed. With SORT_TUPLES,
+// the full record follows the field in memory instead.
 
 typedef struct {
   RID rid;                              // record id of current record
   char* field;                          // pointer to field
   int length;                           // length of field
+  int run;                              // run # (replacement selection)
+  int tupleLen;                         // length of record (SORT_TUPLES)
 } SORTREC;
 
 
+// Encode a sort attribute of len bytes into len bytes whose byte
+// order (memcmp) is the order of the values.
+
+void sortNormalize(const char *value, const Datatype type, const int len,
+		   char *norm);
+
+
+// How SortedFile forms the initial sorted runs:
+//
+//   SORT_RADIX    maxItems records are read into the buffer, radix
+//                 sorted and written out as one run
+//   SORT_REPLACE  replacement selection: the buffer is kept as a heap
+//                 and the smallest record is written out and replaced
+//                 by the next input record. A record smaller than the
+//                 last one written waits for the next run. Runs are
+//                 about 2 * maxItems long on random input, and sorted
+//                 input gives a single run. Runs are generated by a
+//                 single thread.
+//   SORT_TUPLES   like SORT_RADIX, but whole records are copied into
+//                 a sort arena of memBytes bytes and written out from
+//                 there, so the source file is read only once. A run
+//                 holds as many records as fit into the arena; maxItems
+//                 is not used. Runs are generated by a single thread.
+
+enum RunMethod { SORT_RADIX, SORT_REPLACE, SORT_TUPLES };
+
+
 class SortedFile {
  public:
   SortedFile(const string & fileName, 
 	     int offset,// sort source file on the given
 	     int length, Datatype type, // attribute
-	     int maxItems, Status& status);
+	     int maxItems, Status& status,
+	     RunMethod method = SORT_RADIX,
+	     int threads = 1, int memBytes = 0,
+	     const bool (*pred)(const Record & rec, void *arg) = NULL,
+	     void *predArg = NULL);
 
   Status next(Record & rec);            // fetch next record in sort order
   Status setMark();                     // record a position in sort sequence
@@ -34,7 +80,17 @@ class SortedFile {
  private:
   Status sortFile();                    // split source file into sub-runs
   Status generateRun(int numItems);     // generate one sub-run of file
+  Status writeRun(SORTREC* items, int numItems); // write items as a run
+  Status selectRuns();                  // generate runs by repl. selection
+  Status tupleRuns();                   // generate runs of whole records
+  Status parallelRuns();                // generate runs with threads
+  void runWorker(SORTREC* items, int share, bool* done, Status* result);
+  Status mergePasses();                 // merge runs until few are left
+  Status mergeRuns(int count);          // merge first count runs into one
   Status startScans();                  // start a scan on each sorted run
+  Status buildHeap();                   // put the runs with records on heap
+  void siftDown(int i);                 // restore heap order below heap[i]
+  bool runLess(int r1, int r2);         // compare current records of runs
 
   typedef struct {
     string name;                        // name of run file
@@ -44,9 +100,31 @@ class SortedFile {
     Record rec;
     RID rid;                            // RID of current record of run
     RID mark;
+    int recCnt;                         // # of records written to run
+    vector<char> fenceKeys;             // normalized keys of fences
+    vector<RID> fenceRids;              // RIDs of fences
   } RUN;
 
+  Status fetch(RUN & run);              // read next record of a run
+  Status createRun(RUN & run);          // create and open a new run file
+  void addFence(RUN & run, const Record & rec, const RID & rid);
+
+  // parallel merge by key ranges
+  Status parallelMerge();
+  Status openRange(int r, const char *lo, HeapFileScan* & scan);
+  Status nextInRange(HeapFileScan* scan, const char *lo, const char *hi,
+		     Record & rec, vector<char> & norm);
+  void mergeRange(const char *lo, const char *hi, RUN* out, Status* result);
+
   vector<RUN> runs;                   // holds info about each sub-run
+  int runCnt;                           // # of run files created so far
+
+  // Runs that have a current record, kept as a binary min-heap on
+  // the sort attribute so that next() finds the smallest record in
+  // O(log runs). heap[0] is the run next() takes its record from.
+
+  vector<int> heap;                     // indexes into runs
+  bool heapValid;                       // false until built by next()
 
   HeapFile* hfile;                   // source file to sort
   HeapFileScan* hfs;                   // source file to sort
@@ -56,7 +134,14 @@ class SortedFile {
   int length;                           // length of sort attribute
 
   SORTREC* buffer;                      // in-memory sort buffer
+  char* keys;                           // sort attributes of buffer items
+  char* arena;                          // sort arena (SORT_TUPLES)
   int maxItems;                         // max. # of items/tuples in buffer
+  RunMethod method;                     // how runs are generated
+  int threads;                          // # of threads sorting
+  int memBytes;                         // size of sort arena (SORT_TUPLES)
+  const bool (*pred)(const Record & rec, void *arg); // source record filter
+  void *predArg;                        // passed to pred
   int numItems;                         // current # of items in buffer
 };
 